@@ -1,7 +1,10 @@
-#include <pybind11/pybind11.h>
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
 #include <string>
 #include <iostream>
 
+namespace nb = nanobind;
+
 int add(int i, int j) {
     return i + j;
 }
@@ -10,10 +13,10 @@ void print(std::string s){
     std::cout << s << std::endl;
 }
 
-PYBIND11_MODULE(example, m) {
-    m.doc() = "pybind11 example plugin"; // optional module docstring
+NB_MODULE(example, m) {
+    m.doc() = "nanobind example plugin"; // optional module docstring
 
     m.def("add", &add, "A function which adds two numbers");
 
     m.def("print", &print, "A function to print a string");
-}
\ No newline at end of file
+}
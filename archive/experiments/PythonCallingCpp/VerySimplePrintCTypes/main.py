@@ -1,17 +1,25 @@
-from ctypes import cdll
+from ctypes import cdll, c_char_p, c_void_p
 libprint = cdll.LoadLibrary('./libprint.so')
 
+libprint.Foo_new.restype = c_void_p
+libprint.Foo_print.argtypes = [c_void_p]
+libprint.Foo_print_string.argtypes = [c_void_p, c_char_p]
+libprint.Foo_delete.argtypes = [c_void_p]
+
 class Foo(object):
     def __init__(self):
         self.obj = libprint.Foo_new()
 
+    def __del__(self):
+        libprint.Foo_delete(self.obj)
+
     def print(self,string = None):
         if string is not None:
-            libprint.Foo_print_string(self.obj,string)
+            libprint.Foo_print_string(self.obj,string.encode())
         else:
             libprint.Foo_print(self.obj)
 
 if __name__ == "__main__":
     f = Foo()
     f.print()
-    f.print("World")
\ No newline at end of file
+    f.print("World")
@@ -4,15 +4,22 @@
 class Foo{
     public:
         void print(){
-            std::cout << "Hello" << std::endl;
+            std::cout << "Hello" << '\n';
+        }
+        void print(const char* s){
+            std::cout << s << '\n';
         }
         void print(std::string s){
-            std::cout << s << std::endl;
+            std::cout << s << '\n';
         }
 };
 
 extern "C" {
+    // ctypes can only describe C types: taking std::string by value
+    // here was ABI-incompatible (and copied); const char* is what the
+    // Python side actually passes.
     Foo* Foo_new(){ return new Foo(); }
     void Foo_print(Foo* foo){ foo->print(); }
-    void Foo_print_string(Foo* foo, std::string s){ foo->print(s); }
-}
\ No newline at end of file
+    void Foo_print_string(Foo* foo, const char* s){ foo->print(s); }
+    void Foo_delete(Foo* foo){ delete foo; }
+}
@@ -1,81 +1,130 @@
 #include "board.hpp"
-#include <algorithm>
 #include <iostream>
-#include <numeric>
-#include <experimental/iterator>
+#include <random>
 
-Board::Board() {}
+uint64_t zobrist[14][49];
+uint64_t zobristSide;
 
-Board::Board(const Board &board) {
-  m_board = board.m_board;
-  m_mancala = board.m_mancala;
+static bool initZobrist() {
+  std::mt19937_64 rng(0x6d616e63616c61ULL);
+  for (int cell = 0; cell < 14; cell++)
+    for (int count = 0; count < 49; count++)
+      zobrist[cell][count] = rng();
+  zobristSide = rng();
+  return true;
 }
+static bool zobristReady = initZobrist();
 
-void Board::executeTurn(int move) {
-  bool currentSide = m_player2Turn;
+Board::Board() {
+  for (int c = 0; c < 14; c++)
+    m_hash ^= zobrist[c][cell(c)];
+  if (m_player2Turn)
+    m_hash ^= zobristSide;
+}
+
+MoveUndo Board::executeTurn(int move) {
+  MoveUndo u = {m_rows, m_rowSum, m_gameOver, m_player2Turn, m_hash};
+  int side = m_player2Turn;
+  int myMancala = side * 7 + 6;
 
-  int currentSpace = move + 1;
-  int movingMarbles = m_board[m_player2Turn][move];
+  int currentSpace = side * 7 + move;
+  int movingMarbles = cell(currentSpace);
 
   bool switchTurns = true;
 
-  m_board[m_player2Turn][move] = 0;
+  setCell(currentSpace, 0);
+  m_rowSum[side] -= movingMarbles;
 
   if (movingMarbles == 0) {
     m_gameOver = true;
-    m_mancala[m_player2Turn] = -1;
-    return;
+    setCell(myMancala, EMPTY_MOVE_LOSS);
+    return u;
   }
 
-  while (movingMarbles > 0) {
-    if (currentSpace > 5) {
-      m_mancala[currentSide] += 1;
-      currentSpace = 0;
-      currentSide = !currentSide;
-      if (movingMarbles == 1)
-        switchTurns = false;
-    } else {
-      m_board[currentSide][currentSpace] += 1;
-      currentSpace += 1;
-    }
-    movingMarbles -= 1;
+  // Sowing order for each side, skipping the opponent's mancala: 13
+  // active cells, so full laps of 13 add one marble everywhere and only
+  // the remainder needs to walk the table.
+  static const int8_t nextCell[2][14] = {
+      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 0, 0},
+      {1, 2, 3, 4, 5, 7, 7, 8, 9, 10, 11, 12, 13, 0}};
+  const int8_t *next = nextCell[side];
+
+  int laps = movingMarbles / 13;
+  if (laps) {
+    m_rows[side] += LAP_ALL * laps;
+    m_rows[1 - side] += LAP_PITS * laps;
+    m_rowSum[0] += 6 * laps;
+    m_rowSum[1] += 6 * laps;
   }
-  currentSpace -= 1;
-  if (currentSpace < 6 && currentSpace >= 0 &&
-      m_board[currentSide][currentSpace] == 1 && currentSide == m_player2Turn &&
-      m_board[not currentSide][5 - currentSpace] > 0) {
-    m_mancala[currentSide] += m_board[not currentSide][5 - currentSpace] + 1;
-    m_board[not currentSide][5 - currentSpace] = 0;
-    m_board[currentSide][currentSpace] = 0;
+  for (int rem = movingMarbles % 13; rem > 0; rem--) {
+    currentSpace = next[currentSpace];
+    addCell(currentSpace, 1);
+    if (currentSpace != 6 && currentSpace != 13)
+      m_rowSum[currentSpace / 7] += 1;
   }
+  // A remainder of zero means the last marble of the final lap landed
+  // back in the emptied start pit, which is where currentSpace still is.
+  if (currentSpace == myMancala)
+    switchTurns = false;
 
-  if (std::accumulate(m_board[0].begin(), m_board[0].end(), 0) == 0) {
-    m_gameOver = true;
-    m_mancala[1] += std::accumulate(m_board[0].begin(), m_board[0].end(), 0);
+  int pit = currentSpace - side * 7;
+  int opposite = (1 - side) * 7 + 5 - pit;
+  if (pit >= 0 && pit < 6 && cell(currentSpace) == 1 && cell(opposite) > 0) {
+    addCell(myMancala, cell(opposite) + 1);
+    m_rowSum[1 - side] -= cell(opposite);
+    m_rowSum[side] -= 1;
+    setCell(opposite, 0);
+    setCell(currentSpace, 0);
   }
 
-  if (std::accumulate(m_board[1].begin(), m_board[1].end(), 0) == 0) {
+  // When either row empties the game ends and the other side sweeps its
+  // remaining marbles into its own mancala.
+  if ((m_rows[0] & PITS_MASK) == 0 || (m_rows[1] & PITS_MASK) == 0) {
     m_gameOver = true;
-    m_mancala[0] += std::accumulate(m_board[1].begin(), m_board[1].end(), 0);
+    int other = (m_rows[0] & PITS_MASK) == 0 ? 1 : 0;
+    addCell(other * 7 + 6, m_rowSum[other]);
+    m_rows[other] &= ~PITS_MASK;
+    m_rowSum[other] = 0;
   }
+
   if (switchTurns)
 	  m_player2Turn = !m_player2Turn;
+
+  for (int c = 0; c < 14; c++) {
+    int prev = int(u.rows[c / 7] >> (6 * (c % 7))) & 63;
+    int after = cell(c);
+    if (after != prev)
+      m_hash ^= zobrist[c][prev] ^ zobrist[c][after];
+  }
+  if (switchTurns)
+    m_hash ^= zobristSide;
+  return u;
+}
+
+void Board::undo(const MoveUndo &u) {
+  m_rows = u.rows;
+  m_rowSum = u.rowSum;
+  m_gameOver = u.gameOver;
+  m_player2Turn = u.player2Turn;
+  m_hash = u.hash;
 }
 
 void Board::print(){
-	std::copy(m_board[0].begin(), m_board[0].end(), std::experimental::make_ostream_joiner(std::cout, " "));
-	std::cout << std::endl;
-  std::cout << m_mancala[0] << "        " << m_mancala[1] << std::endl;
-	std::copy(m_board[1].begin(), m_board[1].end(), std::experimental::make_ostream_joiner(std::cout, " "));
-	std::cout << std::endl;
+  for (int p = 0; p < 6; p++)
+    std::cout << cell(p) << (p < 5 ? " " : "");
+  std::cout << "\n";
+  std::cout << mancala(false) << "        " << mancala(true) << "\n";
+  for (int p = 7; p < 13; p++)
+    std::cout << cell(p) << (p < 12 ? " " : "");
+  std::cout << "\n";
 }
 
 int Board::score(bool player,int depth){
-	if (m_gameOver && m_mancala[player] > m_mancala[! player])
+	int myMancala = mancala(player);
+	int theirMancala = mancala(!player);
+	if (m_gameOver && myMancala > theirMancala)
 		return 500 + depth;
 	else if (m_gameOver)
 		return -500 - depth;
-	return m_mancala[player] - m_mancala[! player] + 
-    std::accumulate(m_board[player].begin(), m_board[player].end(), 0) -
-    std::accumulate(m_board[! player].begin(), m_board[! player].end(), 0);
+	return myMancala - theirMancala + m_rowSum[player] - m_rowSum[!player];
 }
@@ -1,16 +1,75 @@
 #pragma once
 
-#include <vector>
+#include <array>
+#include <cstdint>
+#include <type_traits>
 
+// Zobrist keys: one per (cell, marble count) pair plus a side-to-move key.
+extern uint64_t zobrist[14][49];
+extern uint64_t zobristSide;
+
+// Pre-move state saved by executeTurn so undo() can restore it.
+struct MoveUndo {
+  std::array<uint64_t, 2> rows;
+  std::array<int8_t, 2> rowSum;
+  bool gameOver;
+  bool player2Turn;
+  uint64_t hash;
+};
+
+// The board is two packed words, one per side, 6 bits per cell: fields
+// 0-5 are that side's pits, field 6 its mancala. Cell indices stay
+// 0-13 as before (0-5 player 1 pits, 6 its mancala, 7-12 player 2
+// pits, 13 its mancala); cell i lives in word i/7, field i%7. A pit
+// holds at most 48 marbles, so 6-bit fields never carry into their
+// neighbours and whole-row operations are single-word arithmetic.
 class Board{
 	public:
-      std::vector<std::vector<int>> m_board = {{4,4,4,4,4,4},{4,4,4,4,4,4}};
-      std::vector<int> m_mancala = {0,0};
+      // Each field's low bit sits at 6*(i%7); 4 in every pit, empty mancala.
+      static const uint64_t INITIAL_ROW = 0x104104104ULL;
+      // Low six fields of a row word, i.e. the pits without the mancala.
+      static const uint64_t PITS_MASK = (1ULL << 36) - 1;
+      // One marble in every field of a row / in every pit of a row.
+      static const uint64_t LAP_ALL = 0x1041041041ULL;
+      static const uint64_t LAP_PITS = 0x0041041041ULL;
+      // Mancala count 63 encodes the -1 "moved from an empty pit" loss
+      // marker; real counts never exceed 48.
+      static const int EMPTY_MOVE_LOSS = 63;
+
+      std::array<uint64_t, 2> m_rows = {INITIAL_ROW, INITIAL_ROW};
+      // Running marble count per row of pits, so emptiness and score
+      // checks don't re-sum the cells every turn.
+      std::array<int8_t, 2> m_rowSum = {24, 24};
       bool m_gameOver = false;
       bool m_player2Turn = true;
+      uint64_t m_hash = 0;
+
+      int cell(int i) const {
+        return int(m_rows[i / 7] >> (6 * (i % 7))) & 63;
+      }
+      // Signed view of a mancala: decodes the EMPTY_MOVE_LOSS marker.
+      int mancala(bool side) const {
+        int v = cell(side * 7 + 6);
+        return v == EMPTY_MOVE_LOSS ? -1 : v;
+      }
+      void setCell(int i, int v) {
+        int shift = 6 * (i % 7);
+        m_rows[i / 7] =
+            (m_rows[i / 7] & ~(63ULL << shift)) | (uint64_t(v) << shift);
+      }
+      void addCell(int i, int n) {
+        m_rows[i / 7] += uint64_t(n) << (6 * (i % 7));
+      }
+
       Board();
-      Board(const Board &board);
-      void executeTurn(const int move);
+      Board(const Board &board) = default;
+      MoveUndo executeTurn(const int move);
+      void undo(const MoveUndo &u);
       void print();
       int score(bool player, int depth);
 };
+
+// Copies (root parallel search, undo snapshots) should stay plain
+// memcpys; a user-defined copy constructor would defeat that.
+static_assert(std::is_trivially_copyable<Board>::value,
+              "Board must be trivially copyable");
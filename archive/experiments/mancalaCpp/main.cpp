@@ -6,11 +6,16 @@ int main(){
     Board board;
     board.print();
     while (!board.m_gameOver){ 
-    	int move = Minimax(board,3,board.m_player2Turn)[1]; 
+	// Iterative deepening: each pass seeds the transposition table so
+	// the next depth searches the previous best move first.
+	std::pair<int,int> best;
+	for (int d = 1; d <= 3; d++)
+		best = MinimaxRoot(board,d,board.m_player2Turn);
+	int move = best.second;
 	//std::cin >> move;
-	std::cout << move << std::endl;
+	std::cout << move << "\n";
 	board.executeTurn(move);
 	board.print();
-	std::cout << board.m_player2Turn << std::endl;
+	std::cout << board.m_player2Turn << "\n";
     }
 }
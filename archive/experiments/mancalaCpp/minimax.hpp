@@ -1,34 +1,175 @@
 #include "board.hpp"
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <utility>
 #include <vector>
 
-inline std::vector<int> Minimax(Board &b, int depth, bool player) {
+enum : uint8_t { TT_EXACT, TT_LOWER, TT_UPPER };
+
+// Lock-free transposition table entry: data packs score/depth/flag/move
+// and check holds key^data, so a torn write from another thread simply
+// fails validation instead of corrupting the search.
+struct TTEntry {
+  std::atomic<uint64_t> check{0};
+  std::atomic<uint64_t> data{0};
+};
+
+struct TTProbe {
+  bool hit = false;
+  int score = 0;
+  int depth = -1;
+  uint8_t flag = TT_EXACT;
+  int bestMove = -1;
+};
+
+const int TT_SIZE = 1 << 20;
+inline std::vector<TTEntry> tt(TT_SIZE);
+
+inline uint64_t ttPack(int score, int depth, uint8_t flag, int bestMove) {
+  return (uint64_t(uint16_t(score)) << 0) | (uint64_t(uint8_t(depth)) << 16) |
+         (uint64_t(flag) << 24) | (uint64_t(uint8_t(bestMove)) << 32);
+}
+
+inline TTProbe ttProbe(uint64_t key) {
+  TTEntry &entry = tt[key & (TT_SIZE - 1)];
+  uint64_t data = entry.data.load(std::memory_order_relaxed);
+  uint64_t check = entry.check.load(std::memory_order_relaxed);
+  TTProbe p;
+  if ((check ^ data) != key)
+    return p;
+  p.hit = true;
+  p.score = int16_t(data & 0xFFFF);
+  p.depth = int8_t((data >> 16) & 0xFF);
+  p.flag = uint8_t((data >> 24) & 0xFF);
+  p.bestMove = int8_t((data >> 32) & 0xFF);
+  return p;
+}
+
+inline void ttStore(uint64_t key, int score, int depth, uint8_t flag,
+                    int bestMove) {
+  TTEntry &entry = tt[key & (TT_SIZE - 1)];
+  uint64_t data = ttPack(score, depth, flag, bestMove);
+  entry.data.store(data, std::memory_order_relaxed);
+  entry.check.store(key ^ data, std::memory_order_relaxed);
+}
+
+// Distinguishes searches scoring for player 2 from those scoring for
+// player 1 so persisted entries don't flip sign between root calls.
+const uint64_t zobristPlayer = 0x9e3779b97f4a7c15ULL;
+
+inline std::pair<int, int> Minimax(Board &b, int depth, bool player, int alpha,
+                                   int beta) {
   // b.print();
   if (depth == 0 || b.m_gameOver)
     return {b.score(player, depth), -1};
+
+  uint64_t key = b.m_hash ^ (player ? zobristPlayer : 0);
+  TTProbe probe = ttProbe(key);
+  if (probe.hit && probe.depth >= depth) {
+    if (probe.flag == TT_EXACT)
+      return {probe.score, probe.bestMove};
+    if (probe.flag == TT_LOWER)
+      alpha = std::max(alpha, probe.score);
+    else
+      beta = std::min(beta, probe.score);
+    if (alpha >= beta)
+      return {probe.score, probe.bestMove};
+  }
+  int alphaOrig = alpha;
+  int betaOrig = beta;
+
+  // Try the best move from a previous (shallower) visit first; with
+  // alpha-beta a good first move prunes most of the remaining siblings.
+  int order[6] = {0, 1, 2, 3, 4, 5};
+  if (probe.hit && probe.bestMove >= 0)
+    std::swap(order[0], order[probe.bestMove]);
+
+  std::pair<int, int> v;
   if (player == b.m_player2Turn) {
-    std::vector<int> v = {-10000, -1};
+    v = {-10000, -1};
     int bestScore = -10000;
-    for (int i = 0; i < 6; i++) {
-      Board newBoard = b;
-      newBoard.executeTurn(i);
-      std::vector<int> result = Minimax(newBoard, depth - 1, player);
-      v[0] = v[0] > result[0] ? v[0] : result[0];
-    std::cout << "Best " << bestScore << " depth-" << depth << " move " << v[1] << " score " << v[0] << std::endl;
-      if (v[0] > bestScore) {
-        bestScore = v[0];
-        v[1] = i;
+    for (int n = 0; n < 6; n++) {
+      int i = order[n];
+      MoveUndo u = b.executeTurn(i);
+      std::pair<int, int> result = Minimax(b, depth - 1, player, alpha, beta);
+      b.undo(u);
+      v.first = v.first > result.first ? v.first : result.first;
+      if (v.first > bestScore) {
+        bestScore = v.first;
+        v.second = i;
       }
+      alpha = std::max(alpha, result.first);
+      if (alpha >= beta)
+        break;
     }
-    return v;
   } else {
-    std::vector<int> v = {10000, -1};
-    for (int i = 0; i < 6; i++) {
-      Board newBoard = b;
-      newBoard.executeTurn(i);
-      std::vector<int> result = Minimax(newBoard, depth - 1, player);
-      v[0] = v[0] < result[0] ? v[0] : result[0];
+    v = {10000, -1};
+    int bestScore = 10000;
+    for (int n = 0; n < 6; n++) {
+      int i = order[n];
+      MoveUndo u = b.executeTurn(i);
+      std::pair<int, int> result = Minimax(b, depth - 1, player, alpha, beta);
+      b.undo(u);
+      v.first = v.first < result.first ? v.first : result.first;
+      if (v.first < bestScore) {
+        bestScore = v.first;
+        v.second = i;
+      }
+      beta = std::min(beta, result.first);
+      if (alpha >= beta)
+        break;
+    }
+  }
+
+  uint8_t flag;
+  if (v.first <= alphaOrig)
+    flag = TT_UPPER;
+  else if (v.first >= betaOrig)
+    flag = TT_LOWER;
+  else
+    flag = TT_EXACT;
+  ttStore(key, v.first, depth, flag, v.second);
+  return v;
+}
+
+// Parallel root: search the (TT-ordered) first move serially to get a
+// real alpha bound, then fan the remaining five out to async tasks on
+// their own board copies — the young-brothers-wait scheme.
+inline std::pair<int, int> MinimaxRoot(Board &b, int depth, bool player) {
+  if (depth == 0 || b.m_gameOver)
+    return {b.score(player, depth), -1};
+
+  uint64_t key = b.m_hash ^ (player ? zobristPlayer : 0);
+  TTProbe probe = ttProbe(key);
+  int order[6] = {0, 1, 2, 3, 4, 5};
+  if (probe.hit && probe.bestMove >= 0)
+    std::swap(order[0], order[probe.bestMove]);
+
+  Board first = b;
+  first.executeTurn(order[0]);
+  std::atomic<int> alpha{Minimax(first, depth - 1, player, -10000, 10000).first};
+  std::pair<int, int> v = {alpha.load(), order[0]};
+
+  std::future<int> results[6];
+  for (int n = 1; n < 6; n++)
+    results[n] = std::async(std::launch::async, [&b, &alpha, depth, player,
+                                                 i = order[n]]() {
+      Board child = b;
+      child.executeTurn(i);
+      return Minimax(child, depth - 1, player, alpha.load(), 10000).first;
+    });
+
+  for (int n = 1; n < 6; n++) {
+    int score = results[n].get();
+    if (score > v.first) {
+      v = {score, order[n]};
+      int seen = alpha.load();
+      while (seen < score && !alpha.compare_exchange_weak(seen, score))
+        ;
     }
-    return v;
   }
+  ttStore(key, v.first, depth, TT_EXACT, v.second);
+  return v;
 }
@@ -0,0 +1,5 @@
+#include "ASTArena.hpp"
+
+namespace ast {
+    ASTArena g_arena;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ast {
+    // Bump-pointer arena for AST nodes. Nodes live for the whole
+    // compile anyway, so they are allocated contiguously out of 64 KB
+    // slabs and released all at once when the arena goes away instead
+    // of one general-purpose new per node.
+    class ASTArena {
+    public:
+        template<class T, class... Args>
+        T *make(Args &&... args) {
+            void *p = allocate(sizeof(T), alignof(T));
+            return new(p) T(std::forward<Args>(args)...);
+        }
+
+    private:
+        static const std::size_t SLAB_SIZE = 64 * 1024;
+
+        void *allocate(std::size_t size, std::size_t align) {
+            cur = reinterpret_cast<char *>(
+                    (reinterpret_cast<std::uintptr_t>(cur) + align - 1) & ~(align - 1));
+            if (cur == nullptr || size > std::size_t(end - cur)) {
+                slabs.emplace_back(new char[size > SLAB_SIZE ? size : SLAB_SIZE]);
+                cur = slabs.back().get();
+                end = cur + (size > SLAB_SIZE ? size : SLAB_SIZE);
+            }
+            void *p = cur;
+            cur += size;
+            return p;
+        }
+
+        std::vector<std::unique_ptr<char[]>> slabs;
+        char *cur = nullptr;
+        char *end = nullptr;
+    };
+
+    extern ASTArena g_arena;
+}
@@ -6,8 +6,7 @@
 namespace ast {
 	class Block : public Node {
 	public:
-		Block(StatementSequence *sl) : statementList(sl) {}
-		void emit(){std::cerr<<"Emitting Block"<<std::endl; statementList->emit();}
+		Block(StatementSequence *sl) : Node(BLOCK), statementList(sl) {}
 		StatementSequence *statementList;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include "Emit.hpp"
+
+#include "Block.hpp"
+#include "Program.hpp"
+#include "StatementSequence.hpp"
+#include "expressions/ExpressionList.hpp"
+#include "statements/Stop.hpp"
+
+#include <iostream>
+
+namespace ast {
+    void emit(Node *n) {
+        switch (n->kind) {
+            case Node::PROGRAM: {
+                emit(static_cast<Program *>(n)->block);
+                Stop stop;
+                emit(&stop);
+                break;
+            }
+            case Node::BLOCK:
+                emit(static_cast<Block *>(n)->statementList);
+                break;
+            case Node::STATEMENT_SEQUENCE:
+                for (Statement *s : static_cast<StatementSequence *>(n)->statements) {
+                    if (s != nullptr) {
+                        emit(s);
+                    }
+                }
+                break;
+            case Node::STOP:
+                std::cout << "li $v0, 10 # Stop Statement\n"
+                          << "syscall\n";
+                break;
+            case Node::EXPRESSION_LIST:
+                for (Expression *e : static_cast<ExpressionList *>(n)->expressions) {
+                    if (e) {
+                        emit(e);
+                    }
+                }
+                break;
+            default:
+                // Expression nodes don't produce code on their own yet.
+                break;
+        }
+    }
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "Node.hpp"
+
+namespace ast {
+    // Single switch-on-kind emitter for the whole tree; the compiler
+    // can inline each case instead of paying a virtual call per node.
+    void emit(Node *n);
+}
@@ -4,6 +4,26 @@
 
 class Node {
 public:
-    Node(){}
+    // One tag per concrete node type so emit() can dispatch with a
+    // switch instead of a virtual call per node.
+    enum Kind {
+        PROGRAM,
+        BLOCK,
+        STATEMENT_SEQUENCE,
+        STOP,
+        EXPRESSION_LIST,
+        VALUE,
+        ADDITION,
+        SUBTRACTION,
+        MULTIPLICATION,
+        DIVISION,
+        EQUAL,
+        NOT_EQUAL,
+        UNARY_MINUS
+    };
+
+    Node(Kind k) : kind(k) {}
     virtual ~Node() = default;
+
+    Kind kind;
 };
@@ -9,13 +9,7 @@
 namespace ast {
 	class Program : public Node {
 	public:
-		Program(Block *b) : block(b){}
-		void emit(){
-		    std::cerr<<"Emitting Program"<<std::endl;
-		    block->emit();
-		    ast::Stop stop;
-		    stop.emit();
-		}
+		Program(Block *b) : Node(PROGRAM), block(b){}
 		Block *block;
 	};
 
@@ -1,19 +1,20 @@
-#include "StatementSequence.hpp"
-
-namespace ast {
-    StatementSequence *MakeStatementSequence(Statement *statement, StatementSequence *statementSequence) {
-        if (statementSequence) {
-            if (statement) {
-                statementSequence->add(statement);
-            }
-            return statementSequence;
-
-        } else if (statement) {
-            return new StatementSequence(statement);
-        }
-    }
-
-    StatementSequence *MakeStatementSequence(Statement *statement) {
-        return new StatementSequence(statement);
-    }
+#include "StatementSequence.hpp"
+#include "ASTArena.hpp"
+
+namespace ast {
+    StatementSequence *MakeStatementSequence(Statement *statement, StatementSequence *statementSequence) {
+        if (statementSequence) {
+            if (statement) {
+                statementSequence->add(statement);
+            }
+            return statementSequence;
+
+        } else if (statement) {
+            return g_arena.make<StatementSequence>(statement);
+        }
+    }
+
+    StatementSequence *MakeStatementSequence(Statement *statement) {
+        return g_arena.make<StatementSequence>(statement);
+    }
 }
\ No newline at end of file
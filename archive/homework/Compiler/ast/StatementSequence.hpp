@@ -7,20 +7,10 @@
 namespace ast {
     class StatementSequence : public Node {
     public:
-        StatementSequence(Statement *n) { add(n); }
+        StatementSequence(Statement *n) : Node(STATEMENT_SEQUENCE) { add(n); }
 
         void add(Statement *n) { statements.push_back(n); }
 
-        void emit() {
-            std::cerr << "Emitting StatementList" << std::endl;
-            for (Statement *s : statements) {
-                std::cerr << "Emitting Statement" << std::endl;
-                if (s != nullptr) {
-                    s->emit();
-                }
-            }
-        }
-
         std::vector<Statement *> statements;
 
     };
@@ -5,6 +5,6 @@
 namespace ast {
     class Addition : public Expression {
     public:
-        Addition(Expression *l, Expression *r) : Expression(l, r) {}
+        Addition(Expression *l, Expression *r) : Expression(ADDITION, l, r) {}
     };
 }
\ No newline at end of file
@@ -5,6 +5,6 @@
 namespace ast {
     class Division : public Expression {
     public:
-        Division(Expression *l, Expression *r) : Expression(l, r) {}
+        Division(Expression *l, Expression *r) : Expression(DIVISION, l, r) {}
     };
 }
\ No newline at end of file
@@ -5,6 +5,6 @@
 namespace ast {
     class Equal : public Expression {
     public:
-        Equal(Expression *l, Expression *r) : Expression(l, r) {}
+        Equal(Expression *l, Expression *r) : Expression(EQUAL, l, r) {}
     };
 }
\ No newline at end of file
@@ -7,14 +7,16 @@ namespace ast {
 
     class Expression : public Node {
     public:
-        Expression() {}
+        Expression(Kind k) : Node(k) {}
 
-        Expression(Expression *left, Expression *right) {
+        Expression(Kind k, Expression *left, Expression *right) : Node(k) {
             l = left;
             r = right;
         }
 
-        bool isConst() { return false; }
+        // The kind tag makes this a single load; only literal Values
+        // are constant (until folding collapses a subtree into one).
+        bool isConst() { return kind == VALUE; }
 
         virtual float value(){return 0;}
 
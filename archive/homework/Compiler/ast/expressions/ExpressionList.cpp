@@ -1,19 +1,20 @@
-#include "ExpressionList.hpp"
-
-namespace ast {
-    ExpressionList *MakeExpressionList(Expression *e, ExpressionList *expressionList){
-        if (expressionList) {
-            if (e) {
-                expressionList->add(e);
-            }
-            return expressionList;
-
-        } else if (e) {
-            return new StatementSequence(e);
-        }
-    }
-
-    ExpressionList *MakeExpressionList(Expression *e){
-        return new StatementSequence(e);
-    }
+#include "ExpressionList.hpp"
+#include "../ASTArena.hpp"
+
+namespace ast {
+    ExpressionList *MakeExpressionList(Expression *e, ExpressionList *expressionList){
+        if (expressionList) {
+            if (e) {
+                expressionList->add(e);
+            }
+            return expressionList;
+
+        } else if (e) {
+            return g_arena.make<ExpressionList>(e);
+        }
+    }
+
+    ExpressionList *MakeExpressionList(Expression *e){
+        return g_arena.make<ExpressionList>(e);
+    }
 }
\ No newline at end of file
@@ -1,36 +1,53 @@
-#include "Factory.hpp"
-
-namespace ast {
-
-    Expression *makeAdd(Expression *l, Expression *r) {
-        if (l->isConst() && r->isConst()) {
-            return new Value(l->value() + r->value());
-        } else {
-            return new Addition(l, r);
-        }
-    }
-
-    Expression *makeMult(Expression *l, Expression *r) {
-        if (l->isConst() && r->isConst()) {
-            return new Value(l->value() * r->value());
-        } else {
-            return new Multiplication(l, r);
-        }
-    }
-
-    Expression *makeDiv(Expression *l, Expression *r) {
-        if (l->isConst() && r->isConst()) {
-            return new Value(l->value() / r->value());
-        } else {
-            return new Division(l, r);
-        }
-    }
-
-    Expression *makeSub(Expression *l, Expression *r) {
-        if (l->isConst() && r->isConst()) {
-            return new Value(l->value() - r->value());
-        } else {
-            return new Subtraction(l, r);
-        }
-    }
+#include "Factory.hpp"
+#include "../ASTArena.hpp"
+
+namespace ast {
+
+    // Folding happens bottom-up as the parser builds the tree: when a
+    // subtree collapses to a Value, the parent fold sees two constants
+    // and collapses too, so whole constant expressions reduce to one
+    // node. The identity cases drop no-op operands outright.
+    Expression *makeAdd(Expression *l, Expression *r) {
+        if (l->isConst() && r->isConst()) {
+            return g_arena.make<Value>(l->value() + r->value());
+        } else if (l->isConst() && l->value() == 0) {
+            return r;
+        } else if (r->isConst() && r->value() == 0) {
+            return l;
+        } else {
+            return g_arena.make<Addition>(l, r);
+        }
+    }
+
+    Expression *makeMult(Expression *l, Expression *r) {
+        if (l->isConst() && r->isConst()) {
+            return g_arena.make<Value>(l->value() * r->value());
+        } else if (l->isConst() && l->value() == 1) {
+            return r;
+        } else if (r->isConst() && r->value() == 1) {
+            return l;
+        } else {
+            return g_arena.make<Multiplication>(l, r);
+        }
+    }
+
+    Expression *makeDiv(Expression *l, Expression *r) {
+        if (l->isConst() && r->isConst()) {
+            return g_arena.make<Value>(l->value() / r->value());
+        } else if (r->isConst() && r->value() == 1) {
+            return l;
+        } else {
+            return g_arena.make<Division>(l, r);
+        }
+    }
+
+    Expression *makeSub(Expression *l, Expression *r) {
+        if (l->isConst() && r->isConst()) {
+            return g_arena.make<Value>(l->value() - r->value());
+        } else if (r->isConst() && r->value() == 0) {
+            return l;
+        } else {
+            return g_arena.make<Subtraction>(l, r);
+        }
+    }
 }
\ No newline at end of file
@@ -5,6 +5,6 @@
 namespace ast {
     class Multiplication : public Expression {
     public:
-        Multiplication(Expression *l, Expression *r) : Expression(l, r) {}
+        Multiplication(Expression *l, Expression *r) : Expression(MULTIPLICATION, l, r) {}
     };
 }
\ No newline at end of file
@@ -5,6 +5,6 @@
 namespace ast {
     class NotEqual : public ast::Expression {
     public:
-        NotEqual(Expression *l, Expression *r) : Expression(l, r) {}
+        NotEqual(Expression *l, Expression *r) : Expression(NOT_EQUAL, l, r) {}
     };
 }
\ No newline at end of file
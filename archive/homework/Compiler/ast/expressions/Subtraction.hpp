@@ -5,6 +5,6 @@
 namespace ast {
     class Subtraction : public Expression {
     public:
-        Subtraction(Expression *l, Expression *r) : Expression(l, r) {}
+        Subtraction(Expression *l, Expression *r) : Expression(SUBTRACTION, l, r) {}
     };
 }
\ No newline at end of file
@@ -5,6 +5,6 @@
 namespace ast {
     class UnaryMinus : public ast::Expression {
     public:
-        UnaryMinus(Expression *n) : Expression(n, nullptr) {}
+        UnaryMinus(Expression *n) : Expression(UNARY_MINUS, n, nullptr) {}
     };
 }
\ No newline at end of file
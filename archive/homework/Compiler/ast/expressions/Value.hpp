@@ -5,7 +5,7 @@
 namespace ast {
     class Value : public Expression {
     public:
-        Value(float value) { v = value; }
+        Value(float value) : Expression(VALUE) { v = value; }
 
         float value() { return v; }
 
@@ -6,8 +6,6 @@
 namespace ast{
 class Statement: public Node{
 public:
-    void emit(){
-        std::cerr << "This should be a specific derived" << std::endl;
-    }
+    Statement(Kind k) : Node(k) {}
 };
 }
@@ -5,9 +5,6 @@
 namespace ast {
     class Stop : public Statement {
     public:
-        void emit() {
-            std::cout << "li $v0, 10 # Stop Statement" << std::endl
-                      << "syscall" << std::endl;
-        }
+        Stop() : Statement(STOP) {}
     };
 }
\ No newline at end of file
@@ -1 +1,8 @@
-#include "Register.hpp"
+#include "Register.hpp"
+#include "RegisterPool.hpp"
+
+Register::~Register() {
+    if (m_pool) {
+        m_pool->release(m_index);
+    }
+}
@@ -1,14 +1,29 @@
-#pragma once
-
-class Register {
-    Register(std::string s, bool* available) : m_string(s), m_available(available){
-        *m_available = false;
-    }
-    bool* m_available;
-    std::string m_string;
-    ~Register(){
-        *m_available = true;
-    }
-};
-
-
+#pragma once
+
+#include <string>
+
+class RegisterPool;
+
+// RAII handle to one temporary register; hands its slot back to the
+// pool when it dies. Move-only so exactly one handle owns each slot.
+class Register {
+public:
+    Register(std::string s, RegisterPool *pool, int index)
+            : m_string(s), m_pool(pool), m_index(index) {}
+
+    Register(Register &&other)
+            : m_string(other.m_string), m_pool(other.m_pool), m_index(other.m_index) {
+        other.m_pool = nullptr;
+    }
+
+    Register(const Register &) = delete;
+    Register &operator=(const Register &) = delete;
+
+    ~Register();
+
+    std::string m_string;
+
+private:
+    RegisterPool *m_pool;
+    int m_index;
+};
@@ -1,2 +1,4 @@
-#include "RegisterPool.hpp"
-
+#include "RegisterPool.hpp"
+
+const char *const RegisterPool::names[9] = {
+        "$t1", "$t2", "$t3", "$t4", "$t5", "$t6", "$t7", "$t8", "$t9"};
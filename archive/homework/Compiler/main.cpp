@@ -1,4 +1,5 @@
 #include "globals/symbol_table.hpp"
+#include "ast/Emit.hpp"
 #include "ast/Program.hpp"
 #include "globals/globals.hpp"
 #include <iostream>
@@ -11,5 +12,5 @@ int main()
 {
   yyparse();
   std::cerr << "Done parsing. Now emitting" << std::endl;
-  pNode->emit();
+  ast::emit(pNode.get());
 };
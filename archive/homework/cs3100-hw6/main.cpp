@@ -8,14 +8,14 @@
 #include "tsMap.cpp"
 
 void threadWorker(std::uint16_t threadNum,TSQueue<int> &workQueue, TSMap<int> &resultsMap) {
-	while(workQueue.size()>1){
-		std::cout << ".";
-		std::cout.flush();
-		int digit = workQueue.pop();
+	// pop blocks until work arrives and returns false once the queue is
+	// closed and empty, so no size-polling loop is needed.
+	int digit;
+	while(workQueue.pop(digit)){
 		//int digit = (int)threadNum;
 		int result = computePiDigit(digit);
 		//int result = digit * 2;
-		resultsMap.insert(digit, result);		
+		resultsMap.insert(digit, result);
 	}
 	//cout << "Done" << threadNum;
 }
@@ -31,6 +31,9 @@ int main() {
 	for(int i = 1; i < count; i++){
 		workQueue.push(i);
 	}
+	// All the work is queued up front; closing lets workers drain the
+	// queue and then exit instead of spinning.
+	workQueue.close();
 	TSMap<int> resultsMap;
 	//std::cout << "Data Created" << std::endl;
 	//
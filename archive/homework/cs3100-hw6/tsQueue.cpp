@@ -1,3 +1,4 @@
+#include<condition_variable>
 #include<iostream>
 #include<queue>
 #include<mutex>
@@ -9,11 +10,14 @@ class TSQueue{
 		public:
 			TSQueue();
 			void push(T);
-			T pop();
+			bool pop(T &out);
+			void close();
 			int size();
 		private:
 			mutex qMutex;
-			queue<T> myQueue; 
+			condition_variable qCV;
+			bool qClosed = false;
+			queue<T> myQueue;
 };
 
 template <class T>
@@ -23,16 +27,35 @@ TSQueue<T>::TSQueue(){
 
 template <class T>
 void TSQueue<T>::push(T item){
-	lock_guard<mutex> guard(qMutex);
-	myQueue.push(item);
+	{
+		lock_guard<mutex> guard(qMutex);
+		myQueue.push(item);
+	}
+	qCV.notify_one();
 }
 
+// Blocks until an item is available or the queue is closed and drained.
+// Returns false only when there is nothing left to pop.
 template <class T>
-T TSQueue<T>::pop(){
-	lock_guard<mutex> guard(qMutex);
-		T rValue = myQueue.front();
-		myQueue.pop();
-		return rValue;	
+bool TSQueue<T>::pop(T &out){
+	unique_lock<mutex> lock(qMutex);
+	qCV.wait(lock, [this]{ return !myQueue.empty() || qClosed; });
+	if (myQueue.empty()) {
+		return false;
+	}
+	out = myQueue.front();
+	myQueue.pop();
+	return true;
+}
+
+// Call once producers are done; wakes every waiting consumer.
+template <class T>
+void TSQueue<T>::close(){
+	{
+		lock_guard<mutex> guard(qMutex);
+		qClosed = true;
+	}
+	qCV.notify_all();
 }
 
 template <class T>
@@ -1,14 +1,18 @@
+#include<stdio.h>
 #include<stdlib.h>
 #include<limits.h>
 #include<algorithm>
+#include<deque>
 #include<iostream>
+#include<unordered_set>
 #include<vector>
 #include<fstream>
 
 using namespace std;
 
 int main(){
-	
+	ios_base::sync_with_stdio(false);
+
 	const int REFERENCES = 1000;
 	const int FRAMES = 100;
 	const int PAGES = 250;
@@ -33,17 +37,29 @@ int main(){
 
 	
 
+	// Format a whole row of fault counts into one buffer and write it in
+	// a single call instead of streaming each int through operator<<.
+	char line[SEQUENCES * 8];
+
 	for(int frameCount = 1; frameCount < FRAMES; frameCount++){
 		//cout << "Working on frame: " << frameCount;
-		vector<int> frame;
+		char *p = line;
+		// FIFO order lives in the deque, membership in the hash set, so
+		// the per-reference presence check is O(1) instead of a scan.
+		deque<int> frameQueue;
+		unordered_set<int> inFrame;
+		inFrame.reserve(frameCount);
 		for (int sequence = 0; sequence < SEQUENCES; sequence++){
 			int currentFaultCount = 0;
 			for(int get = 0; get < REFERENCES; get++){
-				if(find(frame.begin(),frame.end(),references[sequence][get]) == frame.end()){
+				int ref = references[sequence][get];
+				if(inFrame.count(ref) == 0){
 					currentFaultCount++;
-					frame.insert(frame.begin(),references[sequence][get]);
-					if(frame.size() > frameCount){
-						frame.pop_back();
+					frameQueue.push_front(ref);
+					inFrame.insert(ref);
+					if(frameQueue.size() > (size_t)frameCount){
+						inFrame.erase(frameQueue.back());
+						frameQueue.pop_back();
 					}
 				}
 			}
@@ -57,9 +73,10 @@ int main(){
 				}
 			}
 			faults[sequence][frameCount] = currentFaultCount;
-			resultsFile << currentFaultCount << ",";
+			p += snprintf(p, sizeof(line) - (p - line), "%d,", currentFaultCount);
 		}
-		resultsFile << endl;
+		*p++ = '\n';
+		resultsFile.write(line, p - line);
 	}
 	cout << "Anomaly detected " << anomalies << " times." << endl;
 	resultsFile.close();
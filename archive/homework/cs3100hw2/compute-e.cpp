@@ -1,16 +1,21 @@
 #include "compute-e.hpp"
 
 long double factorial(int n) {
-	if (n == 1) {
-		return 1;
+	long double f = 1;
+	for (int i = 2; i <= n; i++) {
+		f *= i;
 	}
-	return n * factorial(n - 1);
+	return f;
 }
 
 long double e(int n) {
-	if (n == 0) {
-		return 2; // Janky? Yes. Works? Also yes.
+	// Keep a running factorial instead of recomputing it per term:
+	// f tracks factorial(2k + 1) across iterations.
+	long double sum = 2; // Janky? Yes. Works? Also yes.
+	long double f = 1;
+	for (int k = 1; k <= n; k++) {
+		f *= (2.0L * k) * (2.0L * k + 1);
+		sum += (2.0L * k + 2) / f; // Doesn't do anything past like n=15 shhhhh
 	}
-	return ((long double)(2 * n + 2)) / (factorial(2 * n + 1)) +
-	       e(n - 1); // Doesn't do anything past like n=15 shhhhh
+	return sum;
 }
@@ -18,7 +18,7 @@ void Dirs::push(string s){
 }
 
 void Dirs::print(){
-	for(int i = 0;i < dirStack.size(); i++){
+	for(size_t i = 0;i < dirStack.size(); i++){
 		cout << dirStack[i] << endl;
 	}
 }
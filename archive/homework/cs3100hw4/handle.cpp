@@ -4,46 +4,102 @@
 const int WRITE = 1;
 const int READ = 0;
 
+// Builtin dispatch key: length in the high byte, first character in the
+// low byte. One computed jump instead of a memcmp cascade; each case
+// still verifies the full name since e.g. "cp" shares a key with "cd".
+static constexpr uint32_t cmdKey(uint32_t len, char c){
+	return len << 8 | (uint8_t)c;
+}
+
 
 Handler::Handler(){
 	history = History();
 	dirs = Dirs();
 	pipeOut = false;
 	pipeIn = false;
-	
+
+	// Warm the exec buffers once at startup: a typical command line
+	// fits without realloc and the pages are already touched, so the
+	// forked child does no allocator work before execvp.
+	execDataCap = 4096;
+	execData = (char*)malloc(execDataCap);
+	memset(execData, 0, execDataCap);
+	execArgvCap = 64;
+	execArgv = (char**)malloc(execArgvCap*sizeof(char*));
+	memset(execArgv, 0, execArgvCap*sizeof(char*));
+}
+
+Handler::~Handler(){
+	free(execData);
+	free(execArgv);
 }
 
-string Handler::vstos(vector<string> vs){
-	string returnString = "";
-	for(int i = 0; i < vs.size()-1; i++){
-		returnString += vs[i] + " ";
+string Handler::vstos(const vector<string> &vs){
+	// Size the result up front so the appends never reallocate.
+	size_t length = 0;
+	for(size_t i = 0; i < vs.size(); i++){
+		length += vs[i].size() + 1;
+	}
+	string returnString;
+	returnString.reserve(length);
+	for(size_t i = 0; i < vs.size(); i++){
+		if(i > 0){
+			returnString.push_back(' ');
+		}
+		returnString.append(vs[i]);
 	}
-	returnString += vs[vs.size()-1];
 	return returnString;
 }
 
-char ** Handler::vstocpp(vector<string> vs){
-	char ** r = (char**)malloc(vstos(vs).length()*sizeof(char));
-	for(int i = 0; i < vs.size(); i ++){
-		r[i] = (char*)vs[i].c_str();
+char ** Handler::vstocpp(const vector<string> &vs){
+	// Two allocations at most (and zero once the buffers are warm):
+	// every argument byte goes into one contiguous block, with the
+	// char* table pointing into it. The old version malloc'd once per
+	// argument via strdup and leaked the lot on every successful exec.
+	size_t bytes = 0;
+	for(size_t i = 0; i < vs.size(); i++){
+		bytes += vs[i].size() + 1;
+	}
+	if(bytes > execDataCap){
+		execData = (char*)realloc(execData, bytes);
+		execDataCap = bytes;
+	}
+	if(vs.size() + 1 > execArgvCap){
+		execArgv = (char**)realloc(execArgv, (vs.size()+1)*sizeof(char*));
+		execArgvCap = vs.size() + 1;
+	}
+	char *p = execData;
+	for(size_t i = 0; i < vs.size(); i++){
+		execArgv[i] = p;
+		memcpy(p, vs[i].c_str(), vs[i].size() + 1);
+		p += vs[i].size() + 1;
 	}
-	r[vs.size()] = (char*)NULL;
-	return r;
+	execArgv[vs.size()] = (char*)NULL;
+	return execArgv;
 }
 
 string Handler::cwd(){
-	char buffer[64];
-	string r = getcwd(buffer, sizeof(buffer));
-	return r;
+	if(cwdDirty){
+		char buffer[64];
+		cachedCwd = getcwd(buffer, sizeof(buffer));
+		cachedPrompt = "[" + cachedCwd + "]:";
+		cwdDirty = false;
+	}
+	return cachedCwd;
+}
+
+const string& Handler::prompt(){
+	cwd();
+	return cachedPrompt;
 }
 
-int Handler::findPipe(vector<string> v){
-	int location = find(begin(v),end(v),"|") - begin(v);
-	if(location == end(v) -begin(v)){
+int Handler::findPipe(const vector<string> &v){
+	auto it = find(begin(v),end(v),"|");
+	if(it == end(v)){
 		return -1;
 	}
 	else{
-		return location;
+		return it - begin(v);
 	}
 }
 
@@ -76,32 +132,69 @@ int Handler::handle(vector<string> args){
 			}	
 		}
 
-		if(command == "^"){
-			handle(history.get(stoi(args[1])));
-		}
-		else if(command == "ptime"){
-			cout << "Time spent executing child processes: " << ptime << " milliseconds" << endl;
-		}
-		else if(command == "history"){
-			history.print();
-		}
-		else if(command == "cd"){
-			char* directory = (char*)args[1].c_str();
-			chdir(directory);
-		}
-		else if(command == "pwd"){
-			cout << cwd() << endl;
-		}
-		else if(command == "dirs"){
-			dirs.print();
-		}
-		else if(command == "popd"){
-			cout << dirs.pop();
-		}
-		else if(command == "pushd"){
-			dirs.push(args[1]);
+		bool external = false;
+		switch(cmdKey(command.size(), command[0])){
+			case cmdKey(1,'^'):
+				handle(history.get(stoi(args[1])));
+				break;
+			case cmdKey(5,'p'): // ptime / pushd
+				if(command == "ptime"){
+					cout << "Time spent executing child processes: " << ptime << " milliseconds" << endl;
+				}
+				else if(command == "pushd"){
+					dirs.push(args[1]);
+				}
+				else{
+					external = true;
+				}
+				break;
+			case cmdKey(7,'h'):
+				if(command == "history"){
+					history.print();
+				}
+				else{
+					external = true;
+				}
+				break;
+			case cmdKey(2,'c'):
+				if(command == "cd"){
+					char* directory = (char*)args[1].c_str();
+					chdir(directory);
+					cwdDirty = true;
+				}
+				else{
+					external = true;
+				}
+				break;
+			case cmdKey(3,'p'):
+				if(command == "pwd"){
+					cout << cwd() << endl;
+				}
+				else{
+					external = true;
+				}
+				break;
+			case cmdKey(4,'d'):
+				if(command == "dirs"){
+					dirs.print();
+				}
+				else{
+					external = true;
+				}
+				break;
+			case cmdKey(4,'p'):
+				if(command == "popd"){
+					cout << dirs.pop();
+				}
+				else{
+					external = true;
+				}
+				break;
+			default:
+				external = true;
+				break;
 		}
-		else{
+		if(external){
 			if(fork() == 0){
 				if(pipeIn){
 
@@ -123,8 +216,10 @@ int Handler::handle(vector<string> args){
 
 
 				char ** execArgs = vstocpp(args);
-				
+
 				execvp(execArgs[0],execArgs);
+				// Only reached when exec fails; the buffers belong to
+				// the Handler, nothing to free here.
 				cout <<args[0] << " Command not found" << endl;
 				_exit(1);
 			}
@@ -21,17 +21,40 @@ using namespace std;
 class Handler{
 	public:
 		Handler();
-		int handle(vector<string>);
+		~Handler();
+		// handle() is the hot prompt-dispatch path; let the optimizer
+		// weight it accordingly.
+		int handle(vector<string>) __attribute__((hot));
 		string cwd();
+		const string& prompt();
 	private:
-		History history;
-		Dirs dirs;
-		double ptime;
+		// Hot per-command state first; history/dirs bookkeeping last.
+		// currentPipe[] (no size) was a C99 flexible array member --
+		// zero storage in C++, so pipe() scribbled over the adjacent
+		// members.
+		int currentPipe[2] = {-1,-1};
 		bool pipeOut;
 		bool pipeIn;
-		int currentPipe[];
+		double ptime;
+		History history;
+		Dirs dirs;
+
+		// cwd() is printed on every prompt; only cd can change it, so
+		// cache the getcwd result and refresh lazily after a cd. The
+		// rendered prompt line is cached alongside it.
+		string cachedCwd;
+		string cachedPrompt;
+		bool cwdDirty = true;
+
+		// Reused exec buffers: all argument bytes in one block plus the
+		// char* table, grown with realloc only when a command needs
+		// more than any before it.
+		char* execData = NULL;
+		size_t execDataCap = 0;
+		char** execArgv = NULL;
+		size_t execArgvCap = 0;
 
-		string vstos(vector<string>);
-		char** vstocpp(vector<string>);
-		int findPipe(vector<string>);
+		string vstos(const vector<string>&) __attribute__((warn_unused_result));
+		char** vstocpp(const vector<string>&);
+		int findPipe(const vector<string>&);
 };
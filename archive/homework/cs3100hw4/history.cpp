@@ -4,21 +4,75 @@ History::History(){
 
 }
 
-void History::add(vector<string> commandVector){
-	history.push_back(commandVector);
+// Maps the i-th oldest live entry (0-based) to its ring slot.
+size_t History::slot(size_t i){
+	return (head + HISTSIZE - count + i) % HISTSIZE;
+}
+
+// Rewrites buf with only the live lines, oldest first, and
+// re-linearizes the ring. Runs rarely; amortized O(1) per add.
+void History::compact(){
+	vector<char> newBuf;
+	newBuf.reserve(liveBytes);
+	vector<pair<uint32_t,uint32_t>> newLines;
+	newLines.reserve(count);
+	for(size_t i = 0; i < count; i++){
+		pair<uint32_t,uint32_t> line = lines[slot(i)];
+		newLines.push_back(make_pair((uint32_t)newBuf.size(), line.second));
+		newBuf.insert(newBuf.end(), buf.begin() + line.first, buf.begin() + line.first + line.second);
+	}
+	buf.swap(newBuf);
+	lines.swap(newLines);
+	head = count % HISTSIZE;
+}
+
+void History::add(const vector<string> &commandVector){
+	uint32_t start = (uint32_t)buf.size();
+	for(size_t i = 0; i < commandVector.size(); i++){
+		buf.insert(buf.end(), commandVector[i].begin(), commandVector[i].end());
+		buf.push_back(' ');
+	}
+	uint32_t len = (uint32_t)buf.size() - start;
+	if(count == HISTSIZE){
+		liveBytes -= lines[head].second;
+		lines[head] = make_pair(start, len);
+	}
+	else{
+		lines.push_back(make_pair(start, len));
+		count++;
+	}
+	head = (head + 1) % HISTSIZE;
+	liveBytes += len;
+	if(buf.size() > 2*liveBytes + 4096){
+		compact();
+	}
 }
 
 vector<string> History::get(int count){
-		return history[count - 1];
+		pair<uint32_t,uint32_t> line = lines[slot(count - 1)];
+		vector<string> r;
+		const char *p = buf.data() + line.first;
+		const char *end = p + line.second;
+		while(p < end){
+			const char *q = (const char*)memchr(p, ' ', end - p);
+			if(q == NULL){
+				q = end;
+			}
+			r.push_back(string(p, q - p));
+			p = q + 1;
+		}
+		return r;
 }
 
 void History::print(){
-	cout << "-- Command History --" << endl << endl;
-	for(int i = 0; i < history.size(); i++){
+	// '\n' instead of endl: one flush after the loop rather than one
+	// per history row.
+	cout << "-- Command History --" << '\n' << '\n';
+	for(size_t i = 0; i < count; i++){
+		pair<uint32_t,uint32_t> line = lines[slot(i)];
 		cout << (i+1) << " : ";
-		for( int j = 0; j < history[i].size(); j++){
-				cout << history[i][j] << " ";
-		}
-		cout << endl;
+		cout.write(buf.data() + line.first, line.second);
+		cout << '\n';
 	}
+	cout.flush();
 }
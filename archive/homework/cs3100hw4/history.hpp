@@ -1,6 +1,9 @@
 #pragma once
 
+#include<cstdint>
+#include<cstring>
 #include<iostream>
+#include<utility>
 #include<vector>
 #include<string>
 
@@ -9,9 +12,25 @@ using namespace std;
 class History{
 		public:
 			History();
-			void add(vector<string>);
+			void add(const vector<string>&);
 			vector<string> get(int);
 			void print();
 		private:
-			vector<vector<string>> history;
+			// Arena storage: each command is one space-joined line of
+			// bytes in buf; lines records (offset, length) per command.
+			// print() emits a whole command with a single write and
+			// get() re-tokenizes its line on demand.
+			//
+			// lines is a ring capped at HISTSIZE (bash's default), so a
+			// long-running session keeps bounded memory. Bytes of
+			// dropped commands stay in buf until compact() rewrites it,
+			// which runs when dead bytes outweigh live ones.
+			static const size_t HISTSIZE = 1000;
+			vector<char> buf;
+			vector<pair<uint32_t,uint32_t>> lines;
+			size_t head = 0;      // slot the next add overwrites
+			size_t count = 0;     // live entries, saturates at HISTSIZE
+			size_t liveBytes = 0;
+			size_t slot(size_t i);
+			void compact();
 };
@@ -1,6 +1,8 @@
 #include<iostream>
-#include<sstream>
 #include<string>
+#include<string.h>
+#include<algorithm>
+#include<stdio.h>
 #include<vector>
 #include<signal.h>
 
@@ -8,36 +10,73 @@
 
 using namespace std;
 
-vector<string> split(string split){
-	istringstream splitStream(split);
-	string temp;
-
+vector<string> split(const string &split){
+	// One memchr per token over the raw buffer instead of dragging the
+	// line through an istringstream character by character.
 	vector<string> returnVector;
-	while(std::getline(splitStream, temp, ' ')) {
-			returnVector.push_back(temp);
+	// Spaces bound the token count, so one counting pass up front
+	// sizes the vector and the emplace loop never reallocates.
+	returnVector.reserve(count(split.begin(), split.end(), ' ') + 1);
+	const char *p = split.data();
+	const char *end = p + split.size();
+	while(p < end){
+		const char *q = (const char*)memchr(p, ' ', end - p);
+		if(q == NULL){
+			returnVector.emplace_back(p, end - p);
+			break;
+		}
+		returnVector.emplace_back(p, q - p);
+		p = q + 1;
 	}
 	return returnVector;
 }
 
-void doNothing(int useless){}
-
 int main(int argc, char *argv[]){
-		signal(SIGINT,doNothing);
+		// SIG_IGN lets the kernel drop Ctrl-C without ever entering
+		// userspace; the old no-op handler still cost a dispatch on
+		// every SIGINT. SA_RESTART keeps getline from seeing EINTR.
+		struct sigaction sa{};
+		sa.sa_handler = SIG_IGN;
+		sigemptyset(&sa.sa_mask);
+		sa.sa_flags = SA_RESTART;
+		sigaction(SIGINT, &sa, NULL);
 		Handler handler;
+		// POSIX getline into a buffer that persists across prompts:
+		// no iostreams sentry/locale machinery per line and zero
+		// steady-state allocations once the buffer has grown.
+		char *linebuf = NULL;
+		size_t linecap = 0;
 		bool exit = false;
 		while(!exit){
-			cout << "["<<handler.cwd()<<"]:";
-			string command;
-			if(getline(cin,command)){
-				if (command != "exit"){
-					vector<string> commandVector = split(command);
-					handler.handle(commandVector);
-				}
-				else{
-						exit = true;
-				}
+			// The prompt is pre-rendered and only rebuilt after a cd,
+			// so emitting it is one fwrite instead of three iostreams
+			// insertions.
+			const string &prompt = handler.prompt();
+			fwrite(prompt.data(), 1, prompt.size(), stdout);
+			fflush(stdout);
+			ssize_t n = getline(&linebuf, &linecap, stdin);
+			if(n < 0){
+				break;
+			}
+			if(n > 0 && linebuf[n-1] == '\n'){
+				n--;
+			}
+			// A bare Enter shouldn't pay for split and dispatch.
+			if(n == 0){
+				continue;
+			}
+			string command(linebuf, n);
+			// exit happens once per session; keep the common path
+			// fall-through.
+			if(__builtin_expect(command == "exit", 0)){
+				exit = true;
+			}
+			else{
+				vector<string> commandVector = split(command);
+				handler.handle(move(commandVector));
 			}
 		}
+		free(linebuf);
 }
 
 